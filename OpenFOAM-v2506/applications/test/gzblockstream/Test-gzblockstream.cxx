@@ -0,0 +1,202 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2025 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-gzblockstream
+
+Description
+    Write/read throughput of binary field content for uncompressed,
+    gzip (gzstream) and block-compressed gzip (gzblockstream) files.
+    Also checks the partial (range) reading and the appending of
+    block-compressed files.
+
+\*---------------------------------------------------------------------------*/
+
+#include "argList.H"
+#include "clockTime.H"
+#include "IFstream.H"
+#include "OFstream.H"
+#include "OSspecific.H"
+#include "gzblockstream.H"
+#include "vectorField.H"
+
+using namespace Foam;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+// Main program:
+
+int main(int argc, char *argv[])
+{
+    argList::addNote
+    (
+        "Compare uncompressed, gzip and block-gzip binary field IO"
+    );
+
+    argList::noParallel();
+    argList::noFunctionObjects();
+    argList::addOption
+    (
+        "size",
+        "N",
+        "Number of field values (default: 4000000)"
+    );
+    argList::addOption
+    (
+        "block",
+        "bytes",
+        "Block size for gzblockstream (default: 1048576)"
+    );
+
+    argList args(argc, argv, false, true);
+
+    const label nValues = args.getOrDefault<label>("size", 4000000);
+    const int blockSize = args.getOrDefault<int>("block", 1048576);
+
+    // Smooth content with some noise, similar to a flow field
+    vectorField fld(nValues);
+    forAll(fld, i)
+    {
+        const scalar x = scalar(i)/nValues;
+        fld[i] = vector(Foam::sin(10*x), x*x, scalar(i % 97)/97);
+    }
+
+    const double mbytes = double(fld.size_bytes())/(1024*1024);
+
+    const fileName baseName("gzblockstreamField");
+    const fileName rawName(baseName + "-raw");
+
+    Info<< "Field of " << nValues << " vectors (" << mbytes << " MB)"
+        << nl << nl
+        << "    method   write [s]  [MB/s]   read [s]  [MB/s]"
+        << "  size [MB]  ok" << nl;
+
+    const int oldBlockSize = gzblockstream::blockSize;
+
+    for (const word method : {"raw", "gzip", "block"})
+    {
+        const bool compress = (method != "raw");
+
+        gzblockstream::blockSize = (method == "block" ? blockSize : 0);
+
+        const fileName name(method == "raw" ? rawName : baseName);
+
+        const IOstreamOption streamOpt
+        (
+            IOstreamOption::BINARY,
+            IOstreamOption::compressionType(compress)
+        );
+
+        clockTime timing;
+        {
+            OFstream os(name, streamOpt);
+            os << fld;
+        }
+        const double writeTime = timing.timeIncrement();
+
+        vectorField result;
+        {
+            IFstream is(name, IOstreamOption::BINARY);
+            is >> result;
+        }
+        const double readTime = timing.timeIncrement();
+
+        const fileName actual(compress ? fileName(name + ".gz") : name);
+
+        Info<< "    " << method.c_str() << "  "
+            << "  " << writeTime
+            << "  " << (writeTime > 0 ? mbytes/writeTime : 0)
+            << "  " << readTime
+            << "  " << (readTime > 0 ? mbytes/readTime : 0)
+            << "  " << double(Foam::fileSize(actual))/(1024*1024)
+            << "  " << (result == fld) << nl;
+    }
+
+    gzblockstream::blockSize = oldBlockSize;
+
+    // Partial reading of block-compressed content
+    if (gzblockstream::isBlocked(baseName + ".gz"))
+    {
+        const DynamicList<char> raw(IFstream::readContents(rawName));
+
+        const std::streamoff offset = raw.size()/3;
+        const std::streamsize nbytes = Foam::min(label(3*blockSize), 1000000);
+
+        clockTime timing;
+        const DynamicList<char> part
+        (
+            gzblockstream::readRange(baseName + ".gz", offset, nbytes)
+        );
+        const double rangeTime = timing.elapsedTime();
+
+        const bool same =
+        (
+            part.size() == nbytes
+         && std::equal(part.cbegin(), part.cend(), raw.cbegin() + offset)
+        );
+
+        Info<< nl << "Range read of " << label(nbytes) << " bytes at "
+            << label(offset) << " : " << rangeTime << " s  ok: "
+            << same << nl;
+    }
+
+    // Appending adds further gzip members to the end of the file
+    {
+        const fileName appendName(baseName + "-append.gz");
+
+        gzblockstream::blockSize = blockSize;
+        {
+            ogzblockstream os(appendName);
+            os << "first line" << '\n';
+        }
+        {
+            ogzblockstream os(appendName, std::ios_base::app);
+            os << "second line" << '\n';
+        }
+        gzblockstream::blockSize = oldBlockSize;
+
+        igzblockstream is(appendName);
+        const auto content = is.view();
+
+        const bool same =
+        (
+            std::string(content.data(), content.size())
+         == "first line\nsecond line\n"
+        );
+
+        Info<< nl << "Append : ok: " << same << nl;
+
+        Foam::rm(appendName);
+    }
+
+    Foam::rm(rawName);
+    Foam::rm(baseName + ".gz");
+
+    Info<< nl << "End\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
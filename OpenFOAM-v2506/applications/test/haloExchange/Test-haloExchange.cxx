@@ -0,0 +1,160 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2025 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-haloExchange
+
+Description
+    Compare the batched exchange of processor patch values (haloExchange)
+    with the standard boundary evaluation for volume fields of the cell
+    centres, for each of the exchange modes.
+
+Usage
+    \code
+    mpirun -np 4 Test-haloExchange -parallel
+    \endcode
+
+\*---------------------------------------------------------------------------*/
+
+#include "fvCFD.H"
+#include "haloExchange.H"
+#include "clockTime.H"
+
+// Max difference of the processor patch values from the reference
+template<class GeoField>
+scalar maxDiff(const GeoField& fld, const GeoField& ref)
+{
+    scalar diff = 0;
+
+    forAll(fld.boundaryField(), patchi)
+    {
+        if (fld.boundaryField()[patchi].coupled())
+        {
+            const auto& pfld = fld.boundaryField()[patchi];
+            const auto& pref = ref.boundaryField()[patchi];
+
+            diff = Foam::max(diff, max(mag(pfld - pref)));
+        }
+    }
+
+    return returnReduce(diff, maxOp<scalar>());
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+int main(int argc, char *argv[])
+{
+    argList::addOption
+    (
+        "repeat",
+        "N",
+        "Number of repeated evaluations for timing (default: 100)"
+    );
+
+    #include "setRootCase.H"
+    #include "createTime.H"
+    #include "createMesh.H"
+
+    const label nRepeat = args.getOrDefault<label>("repeat", 100);
+
+    // Reference values: standard evaluation
+    haloExchange::mode = 0;
+
+    volVectorField refU
+    (
+        IOobject("refU", runTime.timeName(), mesh),
+        mesh,
+        dimensionedVector(dimLength, Zero),
+        fvPatchFieldBase::calculatedType()
+    );
+    refU.primitiveFieldRef() = mesh.C().primitiveField();
+    refU.correctBoundaryConditions();
+
+    volScalarField refP("refP", mag(refU));
+    refP.correctBoundaryConditions();
+
+    label nFailed = 0;
+
+    for (const int mode : {0, 1, 2})
+    {
+        haloExchange::mode = mode;
+
+        volVectorField U("U", 0*refU);
+        volScalarField p("p", 0*refP);
+        volScalarField q("q", 0*refP);
+
+        U.primitiveFieldRef() = refU.primitiveField();
+        p.primitiveFieldRef() = refP.primitiveField();
+        q.primitiveFieldRef() = refP.primitiveField();
+
+        // Single field
+        U.correctBoundaryConditions();
+
+        // Several fields, batched
+        UPtrList<volScalarField> flds(2);
+        flds.set(0, &p);
+        flds.set(1, &q);
+        haloExchange::correctBoundaryConditions(flds);
+
+        const scalar diff = Foam::max
+        (
+            maxDiff(U, refU),
+            Foam::max(maxDiff(p, refP), maxDiff(q, refP))
+        );
+
+        if (diff > SMALL)
+        {
+            ++nFailed;
+        }
+
+        // Timing of repeated evaluations
+        clockTime timing;
+        for (label i = 0; i < nRepeat; ++i)
+        {
+            U.correctBoundaryConditions();
+            haloExchange::correctBoundaryConditions(flds);
+        }
+
+        Info<< "mode " << mode << " : max difference " << diff
+            << ", " << nRepeat << " evaluations in "
+            << timing.elapsedTime() << " s" << endl;
+    }
+
+    haloExchange::mode = 0;
+
+    if (nFailed)
+    {
+        Info<< nl << "FAILED for " << nFailed << " modes" << nl << endl;
+        return 1;
+    }
+
+    Info<< "\nEnd\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
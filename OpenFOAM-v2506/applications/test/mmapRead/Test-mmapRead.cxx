@@ -0,0 +1,190 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2025 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-mmapRead
+
+Description
+    Startup (read) benchmark of binary IOField and CompactIOList content,
+    comparing regular stream reading with memory-mapped reading
+    (IMmapStream, optimisation switch mmapReadMinSize).
+
+    Writes the objects once to the current time and then re-reads them
+    with either method. Can be used with any -fileHandler.
+
+\*---------------------------------------------------------------------------*/
+
+#include "argList.H"
+#include "Time.H"
+#include "clockTime.H"
+#include "IOField.H"
+#include "CompactIOList.H"
+#include "IMmapStream.H"
+#include "labelList.H"
+
+using namespace Foam;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+scalar checksum(const vector& val) { return cmptSum(val); }
+scalar checksum(const labelList& val) { return scalar(sum(val)); }
+
+
+// Read an object nRepeat times, return the average time and the last result
+template<class Type>
+double readTimed(const IOobject& io, const label nRepeat, scalar& result)
+{
+    clockTime timing;
+
+    for (label repeat = 0; repeat < nRepeat; ++repeat)
+    {
+        Type obj(io);
+
+        result = 0;
+        for (const auto& val : obj)
+        {
+            result += checksum(val);
+        }
+    }
+
+    return timing.elapsedTime()/max(1, nRepeat);
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+// Main program:
+
+int main(int argc, char *argv[])
+{
+    argList::addNote
+    (
+        "Compare stream and memory-mapped reading of binary fields"
+    );
+
+    argList::noFunctionObjects();  // Disallow function objects
+    argList::addOption
+    (
+        "size",
+        "N",
+        "Number of field values (default: 10000000)"
+    );
+    argList::addOption
+    (
+        "repeat",
+        "N",
+        "Number of reads per method (default: 3)"
+    );
+
+    #include "setRootCase.H"
+    #include "createTime.H"
+
+    const label nValues = args.getOrDefault<label>("size", 10000000);
+    const label nRepeat = args.getOrDefault<label>("repeat", 3);
+
+    IOobject fieldIO
+    (
+        "mmapReadField",
+        runTime.timeName(),
+        runTime,
+        IOobject::MUST_READ,
+        IOobject::NO_WRITE,
+        IOobject::NO_REGISTER
+    );
+
+    IOobject listIO(fieldIO);
+    listIO.rename("mmapReadList");
+
+    // Write (binary) content once
+    {
+        IOobject io(fieldIO);
+        io.readOpt(IOobject::NO_READ);
+
+        IOField<vector> fld(io, nValues);
+        forAll(fld, i)
+        {
+            fld[i] = vector(i, -i, 0.5*i);
+        }
+
+        // Face-like lists of varying size
+        io.rename(listIO.name());
+        CompactIOList<labelList, label> lists(io);
+        lists.resize(nValues/4);
+        forAll(lists, i)
+        {
+            lists[i] = identity(3 + (i % 3), i);
+        }
+
+        const IOstreamOption streamOpt(IOstreamOption::BINARY);
+
+        fld.writeObject(streamOpt, true);
+        lists.writeObject(streamOpt, true);
+
+        Info<< "Wrote " << fld.objectRelPath() << " and "
+            << lists.objectRelPath() << nl << endl;
+    }
+
+    const float oldMinSize = IMmapStream::minFileSize;
+
+    const double mbytes =
+        double(nValues*sizeof(vector))/(1024*1024);
+
+    Info<< "Reading " << nValues << " vectors ("
+        << mbytes << " MB), " << nRepeat << " repeats" << nl << nl
+        << "    method    IOField [s]   [MB/s]  CompactIOList [s]"
+        << "  checksums" << nl;
+
+    for (const bool useMmap : {false, true})
+    {
+        IMmapStream::minFileSize = (useMmap ? 1 : 0);
+
+        scalar fieldSum = 0, listSum = 0;
+
+        const double fieldTime =
+            readTimed<IOField<vector>>(fieldIO, nRepeat, fieldSum);
+
+        const double listTime =
+            readTimed<CompactIOList<labelList, label>>
+            (
+                listIO,
+                nRepeat,
+                listSum
+            );
+
+        Info<< "    " << (useMmap ? "mmap  " : "stream")
+            << "    " << fieldTime
+            << "   " << (fieldTime > 0 ? mbytes/fieldTime : 0)
+            << "  " << listTime
+            << "  " << fieldSum << ' ' << listSum << nl;
+    }
+
+    IMmapStream::minFileSize = oldMinSize;
+
+    Info<< nl << "End\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,286 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2025 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "processorLduInterfaceField.H"
+#include "SubList.H"
+#include "IPstream.H"
+#include "OPstream.H"
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+template<class Type>
+void Foam::haloExchange::exchange
+(
+    const UList<Type>& sendData,
+    UList<Type>& recvData,
+    const label nFields
+) const
+{
+    const label nNbrs = neighbours_.size();
+
+    if (mode == 2)
+    {
+        // Communicator creation is collective: all ranks reach here
+        if (!graphComm_.good())
+        {
+            graphComm_ = UPstream::communicator::neighbours(comm_, neighbours_);
+        }
+
+        List<int> counts(nNbrs);
+        List<int> offsets(nNbrs);
+
+        int offset = 0;
+        forAll(sizes_, nbri)
+        {
+            counts[nbri] = int(nFields*sizes_[nbri]*sizeof(Type));
+            offsets[nbri] = offset;
+            offset += counts[nbri];
+        }
+
+        UPstream::neighbourAllToAllv
+        (
+            sendData.cdata_bytes(), counts, offsets,
+            recvData.data_bytes(), counts, offsets,
+            graphComm_.comm()
+        );
+    }
+    else
+    {
+        const label startOfRequests = UPstream::nRequests();
+
+        label offset = 0;
+        forAll(neighbours_, nbri)
+        {
+            const label count = nFields*sizes_[nbri];
+
+            SubList<Type> recvSlice(recvData, count, offset);
+
+            UIPstream::read
+            (
+                UPstream::commsTypes::nonBlocking,
+                neighbours_[nbri],
+                recvSlice,
+                UPstream::msgType(),
+                comm_
+            );
+
+            UOPstream::write
+            (
+                UPstream::commsTypes::nonBlocking,
+                neighbours_[nbri],
+                SubList<Type>(sendData, count, offset),
+                UPstream::msgType(),
+                comm_
+            );
+
+            offset += count;
+        }
+
+        UPstream::waitRequests(startOfRequests);
+    }
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+template<class Type, template<class> class PatchField, class GeoMesh>
+bool Foam::haloExchange::evaluate
+(
+    const typename GeoMesh::Mesh& mesh,
+    UPtrList<GeometricBoundaryField<Type, PatchField, GeoMesh>>& bflds
+)
+{
+    if constexpr
+    (
+        is_halo_exchangeable<PatchField<Type>>::value
+     && is_contiguous_v<Type>
+    )
+    {
+        // Same conditions as the processor patch fast path
+        if
+        (
+            mode <= 0
+         || !UPstream::parRun()
+         || bflds.empty()
+         || (!std::is_integral_v<Type> && UPstream::floatTransfer)
+        )
+        {
+            return false;
+        }
+
+        const haloExchange& halo =
+            haloExchange::New(static_cast<const polyMesh&>(mesh));
+
+        const label nFields = bflds.size();
+        const auto commsType = UPstream::commsTypes::nonBlocking;
+
+        // Start the evaluation of all other patches
+        const label startOfRequests = UPstream::nRequests();
+
+        for (auto& bfld : bflds)
+        {
+            forAll(bfld, patchi)
+            {
+                if (!halo.isHaloPatch(patchi))
+                {
+                    bfld[patchi].initEvaluate(commsType);
+                }
+            }
+        }
+
+        // Pack the patch internal values: per neighbour, per field
+        List<Type> sendData(nFields*halo.nFaces_);
+        List<Type> recvData(sendData.size());
+
+        label offset = 0;
+        forAll(halo.patchIDs_, nbri)
+        {
+            const label patchi = halo.patchIDs_[nbri];
+            const label size = halo.sizes_[nbri];
+
+            for (const auto& bfld : bflds)
+            {
+                SubList<Type> slice(sendData, size, offset);
+                bfld[patchi].patchInternalField(slice);
+                offset += size;
+            }
+        }
+
+        halo.exchange(sendData, recvData, nFields);
+
+        // Unpack into the processor patch fields
+        offset = 0;
+        forAll(halo.patchIDs_, nbri)
+        {
+            const label patchi = halo.patchIDs_[nbri];
+            const label size = halo.sizes_[nbri];
+
+            for (auto& bfld : bflds)
+            {
+                auto& pfld = bfld[patchi];
+
+                const auto* procFldPtr =
+                    dynamic_cast<const processorLduInterfaceField*>(&pfld);
+
+                if (!procFldPtr)
+                {
+                    FatalErrorInFunction
+                        << "Patch field type " << pfld.type()
+                        << " on processor patch " << pfld.patch().name()
+                        << " does not support batched exchange" << nl
+                        << exit(FatalError);
+                }
+
+                pfld = SubList<Type>(recvData, size, offset);
+                offset += size;
+
+                if (procFldPtr->doTransform())
+                {
+                    procFldPtr->transformCoupleField(pfld);
+                }
+            }
+        }
+
+        // Finish the evaluation of all other patches
+        UPstream::waitRequests(startOfRequests);
+
+        for (auto& bfld : bflds)
+        {
+            forAll(bfld, patchi)
+            {
+                if (!halo.isHaloPatch(patchi))
+                {
+                    bfld[patchi].evaluate(commsType);
+                }
+            }
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+
+template<class Type, template<class> class PatchField, class GeoMesh>
+bool Foam::haloExchange::evaluate
+(
+    const typename GeoMesh::Mesh& mesh,
+    GeometricBoundaryField<Type, PatchField, GeoMesh>& bfld
+)
+{
+    if constexpr (is_halo_exchangeable<PatchField<Type>>::value)
+    {
+        if (mode <= 0 || !UPstream::parRun())
+        {
+            return false;
+        }
+
+        UPtrList<GeometricBoundaryField<Type, PatchField, GeoMesh>> bflds(1);
+        bflds.set(0, &bfld);
+
+        return evaluate(mesh, bflds);
+    }
+    else
+    {
+        return false;
+    }
+}
+
+
+template<class GeoField>
+void Foam::haloExchange::correctBoundaryConditions
+(
+    UPtrList<GeoField>& flds
+)
+{
+    UPtrList<typename GeoField::Boundary> bflds(flds.size());
+
+    forAll(flds, fieldi)
+    {
+        auto& fld = flds[fieldi];
+
+        // updateAccessTime (as per GeometricField::correctBoundaryConditions)
+        fld.setUpToDate();
+        fld.storeOldTimes();
+
+        bflds.set(fieldi, &fld.boundaryFieldRef(false));
+    }
+
+    if (bflds.empty() || !evaluate(flds[0].mesh(), bflds))
+    {
+        for (auto& bfld : bflds)
+        {
+            bfld.evaluate();
+        }
+    }
+}
+
+
+// ************************************************************************* //